@@ -0,0 +1,132 @@
+#include "Debug/PHHitchWatchdog.h"
+
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY(LogPHHitch);
+
+static TAutoConsoleVariable<float> CVarHitchThreshold(
+	TEXT("ph.HitchWatchdog.ThresholdMs"),
+	0.f,
+	TEXT("Frame time in milliseconds above which the last frames of character movement events are dumped. 0 disables the watchdog."));
+
+static TAutoConsoleVariable<int32> CVarHitchFrames(
+	TEXT("ph.HitchWatchdog.Frames"),
+	8,
+	TEXT("Number of frames kept in the character movement event ring buffer."));
+
+static TAutoConsoleVariable<bool> CVarHitchToFile(
+	TEXT("ph.HitchWatchdog.ToFile"),
+	false,
+	TEXT("Also append hitch reports to Saved/Logs/HitchWatchdog.log."));
+
+bool UPHHitchWatchdog::IsEnabled()
+{
+	return CVarHitchThreshold.GetValueOnGameThread() > 0.f;
+}
+
+void UPHHitchWatchdog::Record(const APHCharacter* Character, EPHHitchEventType Type, const TCHAR* Name, int32 Count, double Duration)
+{
+	if (!IsEnabled() || !Character || !Character->GetWorld())
+		return;
+
+	auto* Watchdog = Character->GetWorld()->GetSubsystem<UPHHitchWatchdog>();
+	if (!Watchdog)
+		return;
+
+	FPHHitchEvent Event;
+	Event.Type = Type;
+	Event.Name = Name;
+	Event.CharacterId = Character->GetUniqueID();
+	Event.CharacterName = Character->GetFName();
+	Event.MovementState = Character->GetMovementState();
+	Event.Count = Count;
+	Event.Duration = Duration;
+	Watchdog->AddEvent(Event);
+}
+
+void UPHHitchWatchdog::Tick(float DeltaTime)
+{
+	double Now = FPlatformTime::Seconds();
+	double FrameDuration = FrameStartTime > 0.0 ? Now - FrameStartTime : DeltaTime;
+	FrameStartTime = Now;
+
+	if (!IsEnabled())
+	{
+		Frames.Reset();
+		return;
+	}
+
+	int32 NumFrames = FMath::Max(CVarHitchFrames.GetValueOnGameThread(), 1);
+	if (Frames.Num() != NumFrames)
+	{
+		Frames.SetNum(NumFrames);
+		FrameIndex = 0;
+	}
+
+	Frames[FrameIndex].FrameNumber = GFrameCounter;
+	Frames[FrameIndex].Duration = FrameDuration;
+
+	if (FrameDuration * 1000.0 > CVarHitchThreshold.GetValueOnGameThread())
+		Dump(FrameDuration);
+
+	FrameIndex = (FrameIndex + 1) % Frames.Num();
+	Frames[FrameIndex].Events.Reset();
+}
+
+TStatId UPHHitchWatchdog::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPHHitchWatchdog, STATGROUP_Tickables);
+}
+
+void UPHHitchWatchdog::AddEvent(const FPHHitchEvent& Event)
+{
+	if (Frames.IsValidIndex(FrameIndex))
+		Frames[FrameIndex].Events.Add(Event);
+}
+
+void UPHHitchWatchdog::Dump(double FrameDuration)
+{
+	FString Report = FString::Printf(TEXT("Hitch %.2f ms on %s, last %d frames:\n"), FrameDuration * 1000.0, *GetWorld()->GetName(), Frames.Num());
+
+	for (int32 Offset = 1; Offset <= Frames.Num(); ++Offset)
+	{
+		const FPHHitchFrame& Frame = Frames[(FrameIndex + Offset) % Frames.Num()];
+		if (Frame.FrameNumber == 0)
+			continue;
+
+		Report += FString::Printf(TEXT("  Frame %llu %.2f ms, %d events\n"), Frame.FrameNumber, Frame.Duration * 1000.0, Frame.Events.Num());
+
+		for (const FPHHitchEvent& Event : Frame.Events)
+		{
+			Report += FString::Printf(TEXT("    %s %s %s(%u) %s Count=%d Time=%.3f ms\n"),
+				*UEnum::GetDisplayValueAsText(Event.Type).ToString(),
+				Event.Name,
+				*Event.CharacterName.ToString(),
+				Event.CharacterId,
+				*UEnum::GetDisplayValueAsText(Event.MovementState).ToString(),
+				Event.Count,
+				Event.Duration * 1000.0);
+		}
+	}
+
+	UE_LOG(LogPHHitch, Warning, TEXT("%s"), *Report);
+
+	if (CVarHitchToFile.GetValueOnGameThread())
+		FFileHelper::SaveStringToFile(Report, *(FPaths::ProjectLogDir() / TEXT("HitchWatchdog.log")), FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+}
+
+FPHHitchScope::FPHHitchScope(const APHCharacter* InCharacter, const TCHAR* InName)
+	: Character(InCharacter)
+	, Name(InName)
+	, StartTime(UPHHitchWatchdog::IsEnabled() ? FPlatformTime::Seconds() : 0.0)
+{
+}
+
+FPHHitchScope::~FPHHitchScope()
+{
+	if (StartTime > 0.0)
+		UPHHitchWatchdog::Record(Character, EPHHitchEventType::Scope, Name, 0, FPlatformTime::Seconds() - StartTime);
+}
@@ -0,0 +1,267 @@
+#include "Debug/PHNetProfiler.h"
+
+#include "Engine/ActorChannel.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetSerialization.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Trace/Trace.inl"
+#include "UObject/UnrealType.h"
+
+DEFINE_LOG_CATEGORY(LogPHNetProfiler);
+
+// Network Insights only reads the engine net trace stream, so this channel shows up in the Unreal Insights event log instead.
+UE_TRACE_CHANNEL_DEFINE(PHNetProfilerChannel)
+
+UE_TRACE_EVENT_BEGIN(PHNetProfiler, Summary)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, Bits)
+	UE_TRACE_EVENT_FIELD(uint32, Count)
+	UE_TRACE_EVENT_FIELD(uint8, Direction)
+	UE_TRACE_EVENT_FIELD(uint8, MovementState)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Connection)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+static TAutoConsoleVariable<bool> CVarNetProfilerEnable(
+	TEXT("ph.NetProfiler.Enable"),
+	false,
+	TEXT("Attribute APHCharacter property and RPC bits to connections and movement states."));
+
+static TAutoConsoleVariable<float> CVarNetProfilerInterval(
+	TEXT("ph.NetProfiler.Interval"),
+	60.f,
+	TEXT("Seconds between exported network profile summaries."));
+
+bool UPHNetProfiler::IsEnabled()
+{
+	return CVarNetProfilerEnable.GetValueOnGameThread();
+}
+
+void UPHNetProfiler::RecordProperties(const APHCharacter* Character, const FPHNetPropertySnapshot& OldSnapshot, const FPHNetPropertySnapshot& NewSnapshot, EPHNetDirection Direction)
+{
+	if (!IsEnabled() || !Character || !Character->GetWorld())
+		return;
+
+	auto* Profiler = Character->GetWorld()->GetSubsystem<UPHNetProfiler>();
+	if (!Profiler)
+		return;
+
+	TArray<UNetConnection*> Connections;
+	GetConnections(Character, Direction, true, Connections);
+	if (Connections.Num() == 0)
+		return;
+
+	if (OldSnapshot.bWalking != NewSnapshot.bWalking)
+		Profiler->Add(Character, Connections, TEXT("bWalking"), Direction, 1);
+
+	if (OldSnapshot.bSprinting != NewSnapshot.bSprinting)
+		Profiler->Add(Character, Connections, TEXT("bSprinting"), Direction, 1);
+
+	if (OldSnapshot.RotationMode != NewSnapshot.RotationMode)
+		Profiler->Add(Character, Connections, TEXT("RotationMode"), Direction, FMath::CeilLogTwo(StaticEnum<ERotationMode>()->GetMaxEnumValue()));
+
+	// MovementState and ReplicatedMovement are not sent to the owning connection.
+	if (Direction == EPHNetDirection::Outgoing)
+		Connections.Remove(Character->GetNetConnection());
+
+	if (OldSnapshot.MovementState != NewSnapshot.MovementState)
+		Profiler->Add(Character, Connections, TEXT("MovementState"), Direction, FMath::CeilLogTwo(StaticEnum<EMovementState>()->GetMaxEnumValue()));
+
+	if (OldSnapshot.ReplicatedMovement == NewSnapshot.ReplicatedMovement)
+		return;
+
+	FPHNetPropertySnapshot Snapshot = NewSnapshot;
+	FNetBitWriter Writer(256);
+	bool bSucceeded = false;
+	Snapshot.ReplicatedMovement.NetSerialize(Writer, nullptr, bSucceeded);
+	Profiler->Add(Character, Connections, TEXT("ReplicatedMovement"), Direction, Writer.GetNumBits());
+}
+
+void UPHNetProfiler::RecordRPC(const APHCharacter* Character, UFunction* Function, void* Parameters, EPHNetDirection Direction)
+{
+	if (!IsEnabled() || !Character || !Function || !Character->GetWorld())
+		return;
+
+	auto* Profiler = Character->GetWorld()->GetSubsystem<UPHNetProfiler>();
+	if (!Profiler)
+		return;
+
+	TArray<UNetConnection*> Connections;
+	GetConnections(Character, Direction, Function->HasAnyFunctionFlags(FUNC_NetMulticast), Connections);
+	if (Connections.Num() == 0)
+		return;
+
+	Profiler->Add(Character, Connections, Function->GetFName(), Direction, GetRPCBits(Function, Parameters));
+}
+
+void UPHNetProfiler::Deinitialize()
+{
+	Flush();
+
+	Super::Deinitialize();
+}
+
+void UPHNetProfiler::Tick(float DeltaTime)
+{
+	if (!IsEnabled())
+		return;
+
+	ElapsedTime += DeltaTime;
+	if (ElapsedTime < CVarNetProfilerInterval.GetValueOnGameThread())
+		return;
+
+	ElapsedTime = 0.f;
+	Flush();
+}
+
+TStatId UPHNetProfiler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPHNetProfiler, STATGROUP_Tickables);
+}
+
+static void NetSerializeValue(FNetBitWriter& Writer, FProperty* Property, void* Value)
+{
+	// Object references are counted as a packed NetGUID, resolving them here would export GUIDs as a side effect.
+	if (Property->IsA<FObjectPropertyBase>())
+	{
+		uint32 NetGUID = 0;
+		Writer.SerializeIntPacked(NetGUID);
+		return;
+	}
+
+	if (auto* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper ArrayHelper(ArrayProperty, Value);
+		uint32 Num = ArrayHelper.Num();
+		Writer.SerializeIntPacked(Num);
+
+		for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+			NetSerializeValue(Writer, ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index));
+		return;
+	}
+
+	// Structs without a native NetSerialize are flattened into their fields, the same way the rep layout sends them.
+	auto* StructProperty = CastField<FStructProperty>(Property);
+	if (StructProperty && !(StructProperty->Struct->StructFlags & STRUCT_NetSerializeNative))
+	{
+		for (TFieldIterator<FProperty> It(StructProperty->Struct); It; ++It)
+		{
+			if (It->HasAnyPropertyFlags(CPF_RepSkip))
+				continue;
+
+			for (int32 Index = 0; Index < It->ArrayDim; ++Index)
+				NetSerializeValue(Writer, *It, It->ContainerPtrToValuePtr<void>(Value, Index));
+		}
+		return;
+	}
+
+	Property->NetSerializeItem(Writer, nullptr, Value);
+}
+
+int64 UPHNetProfiler::GetRPCBits(UFunction* Function, void* Parameters)
+{
+	FNetBitWriter Writer(256);
+
+	for (TFieldIterator<FProperty> It(Function); It && (It->PropertyFlags & (CPF_Parm | CPF_ReturnParm)) == CPF_Parm; ++It)
+	{
+		for (int32 Index = 0; Index < It->ArrayDim; ++Index)
+		{
+			// Every parameter but a bool is prefixed with a bit and skipped when it is zeroed.
+			if (!It->IsA<FBoolProperty>())
+			{
+				uint8 bSend = !It->Identical_InContainer(Parameters, nullptr, Index);
+				Writer.WriteBit(bSend);
+				if (!bSend)
+					continue;
+			}
+
+			NetSerializeValue(Writer, *It, It->ContainerPtrToValuePtr<void>(Parameters, Index));
+		}
+	}
+
+	return Writer.GetNumBits();
+}
+
+void UPHNetProfiler::GetConnections(const APHCharacter* Character, EPHNetDirection Direction, bool bMulticast, TArray<UNetConnection*>& OutConnections)
+{
+	auto* NetDriver = Character->GetNetDriver();
+	if (!NetDriver)
+		return;
+
+	if (NetDriver->ServerConnection)
+	{
+		OutConnections.Add(NetDriver->ServerConnection);
+		return;
+	}
+
+	if (Direction == EPHNetDirection::Incoming || !bMulticast)
+	{
+		if (auto* Connection = Character->GetNetConnection())
+			OutConnections.Add(Connection);
+		return;
+	}
+
+	for (UNetConnection* Connection : NetDriver->ClientConnections)
+	{
+		if (Connection && Connection->FindActorChannelRef(const_cast<APHCharacter*>(Character)))
+			OutConnections.Add(Connection);
+	}
+}
+
+void UPHNetProfiler::Add(const APHCharacter* Character, const TArray<UNetConnection*>& Connections, FName Name, EPHNetDirection Direction, int64 Bits)
+{
+	for (UNetConnection* Connection : Connections)
+	{
+		FPHNetProfileKey Key;
+		Key.Connection = FName(*Connection->LowLevelGetRemoteAddress(true));
+		Key.Name = Name;
+		Key.Direction = Direction;
+		Key.MovementState = Character->GetMovementState();
+
+		FPHNetProfileStat& Stat = Stats.FindOrAdd(Key);
+		Stat.Bits += Bits;
+		++Stat.Count;
+	}
+}
+
+void UPHNetProfiler::Flush()
+{
+	if (Stats.Num() == 0)
+		return;
+
+	FString FilePath = FPaths::ProfilingDir() / TEXT("PHNetProfile.csv");
+	FString Timestamp = FDateTime::UtcNow().ToIso8601();
+	FString Csv = FPaths::FileExists(FilePath) ? FString() : FString(TEXT("Time,Connection,Direction,MovementState,Name,Count,Bits\n"));
+
+	for (const TPair<FPHNetProfileKey, FPHNetProfileStat>& Pair : Stats)
+	{
+		FString Connection = Pair.Key.Connection.ToString();
+		FString Name = Pair.Key.Name.ToString();
+
+		UE_TRACE_LOG(PHNetProfiler, Summary, PHNetProfilerChannel)
+			<< Summary.Cycle(FPlatformTime::Cycles64())
+			<< Summary.Bits(Pair.Value.Bits)
+			<< Summary.Count(Pair.Value.Count)
+			<< Summary.Direction(uint8(Pair.Key.Direction))
+			<< Summary.MovementState(uint8(Pair.Key.MovementState))
+			<< Summary.Connection(*Connection, Connection.Len())
+			<< Summary.Name(*Name, Name.Len());
+
+		Csv += FString::Printf(TEXT("%s,%s,%s,%s,%s,%d,%lld\n"),
+			*Timestamp,
+			*Connection,
+			*UEnum::GetDisplayValueAsText(Pair.Key.Direction).ToString(),
+			*UEnum::GetDisplayValueAsText(Pair.Key.MovementState).ToString(),
+			*Name,
+			Pair.Value.Count,
+			Pair.Value.Bits);
+	}
+
+	FFileHelper::SaveStringToFile(Csv, *FilePath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	UE_LOG(LogPHNetProfiler, Log, TEXT("Exported %d entries to %s"), Stats.Num(), *FilePath);
+	Stats.Reset();
+}
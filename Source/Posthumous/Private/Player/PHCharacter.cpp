@@ -1,21 +1,142 @@
 #include "Player/PHCharacter.h"
 #include "Data/PHCharacterData.h"
+#include "Debug/PHHitchWatchdog.h"
+#include "Debug/PHNetProfiler.h"
+#include "Player/PHCharacterMovementComponent.h"
 
+#include "Animation/AnimInstance.h"
 #include "Animation/AnimMontage.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
+#include "Engine/LatentActionManager.h"
 #include "Engine/World.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
 #include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
+
+static constexpr int32 ClimbingProbeCount = 8;
+
+static float SumClimbingLanes(const VectorRegister4Float& Lanes)
+{
+	float Result;
+	VectorStoreFloat1(VectorDot4(Lanes, GlobalVectorConstants::FloatOne), &Result);
+	return Result;
+}
+
+static bool FitClimbingPlane(const float* U, const float* V, const float* D, const float* W, float& OutA, float& OutB, float& OutC)
+{
+	VectorRegister4Float SumW = VectorZeroFloat();
+	VectorRegister4Float SumU = VectorZeroFloat();
+	VectorRegister4Float SumV = VectorZeroFloat();
+	VectorRegister4Float SumD = VectorZeroFloat();
+	VectorRegister4Float SumUU = VectorZeroFloat();
+	VectorRegister4Float SumUV = VectorZeroFloat();
+	VectorRegister4Float SumVV = VectorZeroFloat();
+	VectorRegister4Float SumUD = VectorZeroFloat();
+	VectorRegister4Float SumVD = VectorZeroFloat();
+
+	for (int32 Index = 0; Index < ClimbingProbeCount; Index += 4)
+	{
+		VectorRegister4Float VecU = VectorLoadAligned(U + Index);
+		VectorRegister4Float VecV = VectorLoadAligned(V + Index);
+		VectorRegister4Float VecD = VectorLoadAligned(D + Index);
+		VectorRegister4Float VecW = VectorLoadAligned(W + Index);
+		VectorRegister4Float WU = VectorMultiply(VecW, VecU);
+		VectorRegister4Float WV = VectorMultiply(VecW, VecV);
+
+		SumW = VectorAdd(SumW, VecW);
+		SumU = VectorAdd(SumU, WU);
+		SumV = VectorAdd(SumV, WV);
+		SumD = VectorMultiplyAdd(VecW, VecD, SumD);
+		SumUU = VectorMultiplyAdd(WU, VecU, SumUU);
+		SumUV = VectorMultiplyAdd(WU, VecV, SumUV);
+		SumVV = VectorMultiplyAdd(WV, VecV, SumVV);
+		SumUD = VectorMultiplyAdd(WU, VecD, SumUD);
+		SumVD = VectorMultiplyAdd(WV, VecD, SumVD);
+	}
+
+	float N = SumClimbingLanes(SumW);
+	if (N < 3.f)
+		return false;
+
+	float Su = SumClimbingLanes(SumU);
+	float Sv = SumClimbingLanes(SumV);
+	float Sd = SumClimbingLanes(SumD);
+	float Suu = SumClimbingLanes(SumUU);
+	float Suv = SumClimbingLanes(SumUV);
+	float Svv = SumClimbingLanes(SumVV);
+	float Sud = SumClimbingLanes(SumUD);
+	float Svd = SumClimbingLanes(SumVD);
+
+	// U and V are normalized to the probe pattern, so every term of the determinant scales with N^3.
+	float Det = Suu * (Svv * N - Sv * Sv) - Suv * (Suv * N - Sv * Su) + Su * (Suv * Sv - Svv * Su);
+	if (FMath::Abs(Det) < KINDA_SMALL_NUMBER * N * N * N)
+		return false;
+
+	OutA = (Sud * (Svv * N - Sv * Sv) - Suv * (Svd * N - Sv * Sd) + Su * (Svd * Sv - Svv * Sd)) / Det;
+	OutB = (Suu * (Svd * N - Sv * Sd) - Sud * (Suv * N - Sv * Su) + Su * (Suv * Sd - Svd * Su)) / Det;
+	OutC = (Suu * (Svv * Sd - Svd * Sv) - Suv * (Suv * Sd - Svd * Su) + Sud * (Suv * Sv - Svv * Su)) / Det;
+	return true;
+}
+
+void FPHProxySnapshotBuffer::Add(const FPHProxySnapshot& Snapshot)
+{
+	if (Snapshots.Num() > 0 && Snapshot.Time < Snapshots.Last().Time)
+		return;
+
+	if (Snapshots.Num() >= MaxSnapshots)
+		Snapshots.RemoveAt(0, 1, false);
+
+	Snapshots.Add(Snapshot);
+}
+
+bool FPHProxySnapshotBuffer::Sample(float RenderTime, float MaxExtrapolationTime, FVector& OutLocation, FQuat& OutRotation) const
+{
+	if (Snapshots.Num() == 0)
+		return false;
+
+	const FPHProxySnapshot& Last = Snapshots.Last();
+	if (RenderTime >= Last.Time)
+	{
+		OutLocation = Last.Location;
+		OutRotation = Last.Rotation;
+
+		if (Snapshots.Num() < 2)
+			return true;
+
+		const FPHProxySnapshot& Prev = Snapshots[Snapshots.Num() - 2];
+		float Span = Last.Time - Prev.Time;
+		if (Span > KINDA_SMALL_NUMBER)
+			OutLocation += (Last.Location - Prev.Location) * (FMath::Min(RenderTime - Last.Time, MaxExtrapolationTime) / Span);
+
+		return true;
+	}
+
+	for (int32 Index = Snapshots.Num() - 1; Index > 0; --Index)
+	{
+		const FPHProxySnapshot& From = Snapshots[Index - 1];
+		if (From.Time > RenderTime)
+			continue;
+
+		const FPHProxySnapshot& To = Snapshots[Index];
+		float Span = To.Time - From.Time;
+		float Alpha = Span > KINDA_SMALL_NUMBER ? (RenderTime - From.Time) / Span : 1.f;
+		OutLocation = FMath::Lerp(From.Location, To.Location, Alpha);
+		OutRotation = FQuat::Slerp(From.Rotation, To.Rotation, Alpha);
+		return true;
+	}
+
+	OutLocation = Snapshots[0].Location;
+	OutRotation = Snapshots[0].Rotation;
+	return true;
+}
 
 APHCharacter::APHCharacter(const FObjectInitializer& ObjectInitializer)
-	: Super(ObjectInitializer)
-	, SpringArm(CreateDefaultSubobject<USpringArmComponent>(TEXT("SpringArm")))
-	, Camera(CreateDefaultSubobject<UCameraComponent>(TEXT("Camera")))
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UPHCharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
 	GetCapsuleComponent()->InitCapsuleSize(30.f, 92.f);
 
@@ -23,12 +144,6 @@ APHCharacter::APHCharacter(const FObjectInitializer& ObjectInitializer)
 	GetMesh()->SetRelativeRotation(FRotator(0.f, -90.f, 0.f));
 	GetMesh()->AddTickPrerequisiteActor(this);
 
-	SpringArm->AttachToComponent(GetMesh(), FAttachmentTransformRules::KeepWorldTransform, TEXT("Camera"));
-	SpringArm->TargetArmLength = bUsingFpView ? 0.f : 200.f;
-	SpringArm->bUsePawnControlRotation = true;
-
-	Camera->SetupAttachment(SpringArm);
-
 	GetCharacterMovement()->MovementState.bCanCrouch = true;
 	GetCharacterMovement()->MovementState.bCanFly = true;
 	GetCharacterMovement()->MovementState.bCanJump = true;
@@ -40,11 +155,212 @@ APHCharacter::APHCharacter(const FObjectInitializer& ObjectInitializer)
 	SavedFallingLateralFriction = GetCharacterMovement()->FallingLateralFriction;
 	SavedGroundFriction = GetCharacterMovement()->GroundFriction;
 
+	CameraProbeDelegate.BindUObject(this, &APHCharacter::OnCameraProbeCompleted);
+
 	static ConstructorHelpers::FObjectFinder<UPHCharacterData> CharacterDataAsset(TEXT("/Game/GameData/PHCharacter_DA"));
 	if (CharacterDataAsset.Succeeded())
 		CharacterData = CharacterDataAsset.Object;
 }
 
+void APHCharacter::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (GetLocalRole() == ROLE_SimulatedProxy)
+		TickProxySnapshots();
+
+	if (SpringArm && Camera)
+		UpdateCameraOcclusion(DeltaSeconds);
+}
+
+void APHCharacter::PostNetReceiveLocationAndRotation()
+{
+	if (GetLocalRole() != ROLE_SimulatedProxy || !CharacterData)
+	{
+		Super::PostNetReceiveLocationAndRotation();
+		return;
+	}
+
+	if (ProxyEvents.Num() == 0 && !CharacterData->ProxyInterpParamMap.Contains(MovementState) && !CharacterData->ProxyInterpParamMap.Contains(ProxyMovementState))
+	{
+		// While the buffer drains the newest update is held back, TickProxySnapshots applies it once the buffer is empty.
+		if (ProxySnapshots.IsEmpty())
+			Super::PostNetReceiveLocationAndRotation();
+		return;
+	}
+
+	FPHProxySnapshot Snapshot;
+	Snapshot.Time = GetWorld()->GetTimeSeconds();
+	Snapshot.Location = GetReplicatedMovement().Location;
+	Snapshot.Rotation = GetReplicatedMovement().Rotation.Quaternion();
+	AddProxySnapshot(Snapshot);
+}
+
+void APHCharacter::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	if (!UPHNetProfiler::IsEnabled())
+		return;
+
+	FPHNetPropertySnapshot Snapshot = MakeNetPropertySnapshot();
+	UPHNetProfiler::RecordProperties(this, NetPropertySnapshot, Snapshot, EPHNetDirection::Outgoing);
+	NetPropertySnapshot = Snapshot;
+}
+
+void APHCharacter::PreNetReceive()
+{
+	Super::PreNetReceive();
+
+	if (UPHNetProfiler::IsEnabled())
+		NetPropertySnapshot = MakeNetPropertySnapshot();
+}
+
+void APHCharacter::PostNetReceive()
+{
+	Super::PostNetReceive();
+
+	if (UPHNetProfiler::IsEnabled())
+		UPHNetProfiler::RecordProperties(this, NetPropertySnapshot, MakeNetPropertySnapshot(), EPHNetDirection::Incoming);
+}
+
+void APHCharacter::ProcessEvent(UFunction* Function, void* Parameters)
+{
+	// Received RPCs, including the character movement ones declared on ACharacter, are dispatched through here.
+	if (UPHNetProfiler::IsEnabled() && Function->HasAnyFunctionFlags(FUNC_Net) && (HasAuthority() ? Function->HasAnyFunctionFlags(FUNC_NetServer) && !IsLocallyControlled() : Function->HasAnyFunctionFlags(FUNC_NetMulticast | FUNC_NetClient)))
+		UPHNetProfiler::RecordRPC(this, Function, Parameters, EPHNetDirection::Incoming);
+
+	Super::ProcessEvent(Function, Parameters);
+}
+
+bool APHCharacter::CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack)
+{
+	bool bProcessed = Super::CallRemoteFunction(Function, Parameters, OutParms, Stack);
+
+	if (bProcessed)
+		UPHNetProfiler::RecordRPC(this, Function, Parameters, EPHNetDirection::Outgoing);
+
+	return bProcessed;
+}
+
+FPHNetPropertySnapshot APHCharacter::MakeNetPropertySnapshot() const
+{
+	FPHNetPropertySnapshot Snapshot;
+	Snapshot.bWalking = bWalking;
+	Snapshot.bSprinting = bSprinting;
+	Snapshot.MovementState = MovementState;
+	Snapshot.RotationMode = RotationMode;
+	Snapshot.ReplicatedMovement = GetReplicatedMovement();
+	return Snapshot;
+}
+
+void APHCharacter::RecordRPC(const TCHAR* Name)
+{
+	UPHHitchWatchdog::Record(this, EPHHitchEventType::RPC, Name);
+}
+
+void APHCharacter::DeactivateForPool()
+{
+	bPooled = true;
+	OnRepPooled();
+	GetCharacterMovement()->DisableMovement();
+
+	ForceNetUpdate();
+	SetNetDormancy(DORM_DormantAll);
+}
+
+void APHCharacter::ActivateFromPool(const FTransform& Transform)
+{
+	SetNetDormancy(DORM_Awake);
+
+	SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	bPooled = false;
+	OnRepPooled();
+	GetCharacterMovement()->SetDefaultMovementMode();
+
+	ForceNetUpdate();
+}
+
+void APHCharacter::OnRepPooled()
+{
+	ResetMovementState();
+
+	if (bPooled)
+		DestroyCameraRig();
+
+	SetActorHiddenInGame(bPooled);
+	SetActorEnableCollision(!bPooled);
+	SetActorTickEnabled(!bPooled);
+	GetMesh()->SetComponentTickEnabled(!bPooled);
+	GetCharacterMovement()->SetComponentTickEnabled(!bPooled);
+}
+
+void APHCharacter::ResetMovementState()
+{
+	GetWorldTimerManager().ClearAllTimersForObject(this);
+	if (GetWorld())
+		GetWorld()->GetLatentActionManager().RemoveActionsForObject(this);
+
+	if (Glider)
+		Glider->Destroy();
+
+	Glider = nullptr;
+	ClimbingBase = nullptr;
+	ClimbingNormal = FVector(0.f);
+	DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+
+	if (auto* AnimInstance = GetMesh()->GetAnimInstance())
+		AnimInstance->StopAllMontages(0.f);
+
+	GetMesh()->SetRelativeLocation(GetBaseTranslationOffset());
+	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+
+	bWalking = false;
+	bSprinting = false;
+	bBlockedClimbing = false;
+	bBlockedMovement = false;
+	bCanClimbing = false;
+	bCanGliding = false;
+	bClimbingFromBelow = false;
+	bClimbingFromAbove = false;
+	bJumpingToClimb = false;
+	bMantle = false;
+	bSlidingCrouched = false;
+	bSlidingOnSlope = false;
+	bUsingFpView = true;
+	MantleHeight = 0.f;
+
+	MovementState = EMovementState::None;
+	RotationMode = ERotationMode::CameraDirection;
+
+	ProxySnapshots.Reset();
+	ProxyEvents.Reset();
+	ProxyMovementState = EMovementState::None;
+	ProxyInterpState = EMovementState::None;
+
+	GetCharacterMovement()->StopMovementImmediately();
+	GetCharacterMovement()->SetPlaneConstraintEnabled(false);
+	GetCharacterMovement()->bCanWalkOffLedgesWhenCrouching = bSavedCanWalkOffLedgesWhenCrouching;
+	GetCharacterMovement()->BrakingDecelerationWalking = SavedBrakingDecelerationWalking;
+	GetCharacterMovement()->FallingLateralFriction = SavedFallingLateralFriction;
+	GetCharacterMovement()->GroundFriction = SavedGroundFriction;
+	GetCharacterMovement()->GravityScale = 1.f;
+
+	if (!CharacterData)
+		return;
+
+	GetCharacterMovement()->AirControl = CharacterData->FallingAirControl;
+	GetCharacterMovement()->MaxAcceleration = CharacterData->MaxAcceleration;
+}
+
+void APHCharacter::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (!ShouldRunCosmetics())
+		GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+}
+
 void APHCharacter::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
 {
 	Super::SetupPlayerInputComponent(PlayerInputComponent);
@@ -66,8 +382,9 @@ void APHCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLife
 
 	DOREPLIFETIME(APHCharacter, bWalking);
 	DOREPLIFETIME(APHCharacter, bSprinting);
-	DOREPLIFETIME(APHCharacter, MovementState);
+	DOREPLIFETIME_CONDITION(APHCharacter, MovementState, COND_SkipOwner);
 	DOREPLIFETIME(APHCharacter, RotationMode);
+	DOREPLIFETIME(APHCharacter, bPooled);
 }
 
 void APHCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode)
@@ -77,6 +394,108 @@ void APHCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 P
 	OnMovementModeChanged(PrevMovementMode, GetCharacterMovement()->MovementMode);
 }
 
+void APHCharacter::NotifyControllerChanged()
+{
+	Super::NotifyControllerChanged();
+
+	if (IsLocallyControlled() && IsPlayerControlled())
+		CreateCameraRig();
+	else
+		DestroyCameraRig();
+}
+
+bool APHCharacter::ShouldRunCosmetics() const
+{
+#if UE_SERVER
+	return false;
+#else
+	return !IsNetMode(NM_DedicatedServer);
+#endif
+}
+
+void APHCharacter::CreateCameraRig()
+{
+#if !UE_SERVER
+	if (SpringArm)
+		return;
+
+	SpringArm = NewObject<USpringArmComponent>(this, MakeUniqueObjectName(this, USpringArmComponent::StaticClass(), TEXT("SpringArm")));
+	SpringArm->SetupAttachment(GetMesh(), TEXT("Camera"));
+	SpringArm->TargetArmLength = bUsingFpView ? 0.f : 200.f;
+	SpringArm->SetRelativeLocation(bUsingFpView ? FVector(0.f) : FVector(-3.f, 30.f, 20.f));
+	SpringArm->bUsePawnControlRotation = true;
+	SpringArm->bDoCollisionTest = false;
+	SpringArm->RegisterComponent();
+
+	Camera = NewObject<UCameraComponent>(this, MakeUniqueObjectName(this, UCameraComponent::StaticClass(), TEXT("Camera")));
+	Camera->SetupAttachment(SpringArm);
+	Camera->RegisterComponent();
+
+	CameraProbeLength = CameraArmLength = SpringArm->TargetArmLength;
+	LastCameraProbeStart = FVector(BIG_NUMBER);
+#endif
+}
+
+void APHCharacter::DestroyCameraRig()
+{
+	if (Camera)
+		Camera->DestroyComponent();
+
+	if (SpringArm)
+		SpringArm->DestroyComponent();
+
+	Camera = nullptr;
+	SpringArm = nullptr;
+}
+
+void APHCharacter::UpdateCameraOcclusion(float DeltaSeconds)
+{
+	if (bUsingFpView || !CharacterData || !GetWorld())
+	{
+		CameraProbeLength = CameraArmLength = SpringArm->TargetArmLength;
+		LastCameraProbeStart = FVector(BIG_NUMBER);
+		Camera->SetRelativeLocation(FVector(0.f));
+		return;
+	}
+
+	FVector ProbeStart = SpringArm->GetComponentLocation();
+	FRotator ProbeRotation = GetControlRotation();
+	bool bStationary = ProbeStart.Equals(LastCameraProbeStart, 0.1f) && ProbeRotation.Equals(LastCameraProbeRotation, 0.1f);
+
+	if (!bCameraProbePending && !bStationary)
+	{
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(CameraOcclusion), false, this);
+		FVector ProbeEnd = ProbeStart - ProbeRotation.Vector() * SpringArm->TargetArmLength;
+
+		GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single, ProbeStart, ProbeEnd, FQuat::Identity, SpringArm->ProbeChannel, FCollisionShape::MakeSphere(SpringArm->ProbeSize), QueryParams, FCollisionResponseParams::DefaultResponseParam, &CameraProbeDelegate);
+		bCameraProbePending = true;
+		LastCameraProbeStart = ProbeStart;
+		LastCameraProbeRotation = ProbeRotation;
+	}
+
+	// Snap in so the camera never clips into the blocker, only ease back out once it clears.
+	float TargetLength = FMath::Min(CameraProbeLength, SpringArm->TargetArmLength);
+	CameraArmLength = FMath::Min(CameraArmLength, TargetLength);
+	CameraArmLength = FMath::FInterpTo(CameraArmLength, TargetLength, DeltaSeconds, CharacterData->CameraOcclusionInterpSpeed);
+	Camera->SetRelativeLocation(FVector(SpringArm->TargetArmLength - CameraArmLength, 0.f, 0.f));
+}
+
+void APHCharacter::OnCameraProbeCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	bCameraProbePending = false;
+
+	if (!SpringArm)
+		return;
+
+	CameraProbeLength = SpringArm->TargetArmLength;
+
+	for (const FHitResult& Hit : TraceDatum.OutHits)
+	{
+		if (Hit.bBlockingHit)
+			CameraProbeLength = FMath::Min(CameraProbeLength, SpringArm->TargetArmLength * Hit.Time);
+	}
+}
+
 void APHCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, EMovementMode NewMovementMode)
 {
 	if (bClimbingFromBelow && GetCharacterMovement()->MovementMode != EMovementMode::MOVE_Flying)
@@ -92,32 +511,45 @@ void APHCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, EMoveme
 		return;
 	}
 
+	EMovementState NewMovementState;
 	switch (NewMovementMode)
 	{
 	case EMovementMode::MOVE_Walking:
 	case EMovementMode::MOVE_NavWalking:
-		ChangeMovementState(EMovementState::Ground);
-		return;
+		NewMovementState = EMovementState::Ground;
+		break;
 	case EMovementMode::MOVE_Falling:
-		ChangeMovementState(EMovementState::Falling);
-		return;
+		NewMovementState = EMovementState::Falling;
+		break;
 	case EMovementMode::MOVE_Swimming:
-		ChangeMovementState(EMovementState::Swimming);
+		NewMovementState = EMovementState::Swimming;
+		break;
+	default:
+		return;
 	}
+
+	// A buffered proxy gets the same transition from the replicated MovementState, in step with the interpolated position.
+	if (ShouldBufferProxy(NewMovementState))
+		return;
+
+	ChangeMovementState(NewMovementState);
 }
 
 void APHCharacter::ChangeMovementState(EMovementState InMovementState)
 {
+	FPHHitchScope HitchScope(this, TEXT("ChangeMovementState"));
+
 	if (MovementState == InMovementState || !CharacterData)
 		return;
 
-	if (InMovementState == EMovementState::Gliding)
+	if (InMovementState == EMovementState::Gliding && ShouldRunCosmetics())
 		UKismetSystemLibrary::RetriggerableDelay(this, CharacterData->GliderSpawnDelay, FLatentActionInfo(0, 0, TEXT("SpawnGlider"), this));
 
 	switch (MovementState)
 	{
 	case EMovementState::Climbing:
 		bJumpingToClimb = false;
+		GetWorldTimerManager().ClearTimer(JumpToClimbTimerHandle);
 		DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
 		GetCharacterMovement()->SetPlaneConstraintEnabled(false);
 		break;
@@ -131,23 +563,36 @@ void APHCharacter::ChangeMovementState(EMovementState InMovementState)
 		if (Glider)
 			Glider->Destroy();
 		break;
+	case EMovementState::Mantle:
+		bMantle = false;
+		break;
 	case EMovementState::Swimming:
 		GetCharacterMovement()->MaxAcceleration = CharacterData->MaxAcceleration;
 	}
 
 	MovementState = InMovementState;
+	UPHHitchWatchdog::Record(this, EPHHitchEventType::Transition, TEXT("ChangeMovementState"));
+
+	if (ProxyEvents.Num() == 0)
+		ProxyMovementState = MovementState;
 
 	ApplyMovementState();
 }
 
 void APHCharacter::ServerChangeMovementState_Implementation(EMovementState InMovementState)
 {
+	RecordRPC(TEXT("ServerChangeMovementState"));
+
 	MulticastChangeMovementState(InMovementState);
 }
 
 void APHCharacter::MulticastChangeMovementState_Implementation(EMovementState InMovementState)
 {
-	if (!IsLocallyControlled() && MovementState != InMovementState)
+	RecordRPC(TEXT("MulticastChangeMovementState"));
+
+	if (GetLocalRole() == ROLE_SimulatedProxy)
+		ReceiveProxyMovementState(InMovementState);
+	else if (!IsLocallyControlled() && MovementState != InMovementState)
 		ChangeMovementState(InMovementState);
 }
 
@@ -165,6 +610,8 @@ void APHCharacter::ApplyMovementState()
 	case EMovementState::Climbing:
 	{
 		ClimbingBase = nullptr;
+		ClimbingNormal = -GetActorForwardVector().GetSafeNormal2D();
+		GetCharacterMovement()->SetPlaneConstraintNormal(ClimbingNormal);
 		GetCharacterMovement()->SetPlaneConstraintEnabled(true);
 		GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Flying, 0);
 		bCanClimbing = false;
@@ -172,6 +619,9 @@ void APHCharacter::ApplyMovementState()
 	}
 	case EMovementState::Falling:
 	{
+		if (GetCharacterMovement()->MovementMode != EMovementMode::MOVE_Falling)
+			GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Falling, 0);
+
 		bCanGliding = true;
 		bSlidingOnSlope = false;
 		GetCharacterMovement()->AirControl = CharacterData->FallingAirControl;
@@ -224,11 +674,152 @@ void APHCharacter::ApplyMovementState()
 	}
 }
 
+const FPHProxyInterpParam* APHCharacter::FindProxyInterpParam() const
+{
+	if (!CharacterData)
+		return nullptr;
+
+	if (auto* InterpParam = CharacterData->ProxyInterpParamMap.Find(MovementState))
+		return InterpParam;
+
+	if (auto* InterpParam = CharacterData->ProxyInterpParamMap.Find(ProxyMovementState))
+		return InterpParam;
+
+	if (ProxyEvents.Num() == 0 && ProxySnapshots.IsEmpty())
+		return nullptr;
+
+	return CharacterData->ProxyInterpParamMap.Find(ProxyInterpState);
+}
+
+bool APHCharacter::ShouldBufferProxy(EMovementState InMovementState) const
+{
+	if (GetLocalRole() != ROLE_SimulatedProxy || !CharacterData)
+		return false;
+
+	return ProxyEvents.Num() > 0 || CharacterData->ProxyInterpParamMap.Contains(InMovementState) || FindProxyInterpParam();
+}
+
+void APHCharacter::ReceiveProxyMovementState(EMovementState InMovementState)
+{
+	if (ProxyMovementState == InMovementState)
+		return;
+
+	bool bBuffer = ShouldBufferProxy(InMovementState);
+	ProxyMovementState = InMovementState;
+
+	if (!bBuffer)
+	{
+		ChangeMovementState(InMovementState);
+		return;
+	}
+
+	FPHProxyEvent Event;
+	Event.Time = GetWorld()->GetTimeSeconds();
+	Event.MovementState = InMovementState;
+	Event.bJumpToClimb = false;
+	Event.JumpOrientation = FVector(0.f);
+	AddProxyEvent(Event);
+}
+
+void APHCharacter::OnRepMovementState(EMovementState PrevMovementState)
+{
+	EMovementState ReplicatedMovementState = MovementState;
+	MovementState = PrevMovementState;
+
+	ReceiveProxyMovementState(ReplicatedMovementState);
+}
+
+void APHCharacter::BeginProxyBuffer()
+{
+	if (ProxyEvents.Num() > 0 || !ProxySnapshots.IsEmpty())
+		return;
+
+	GetCharacterMovement()->SetComponentTickEnabled(false);
+
+	if (CharacterData && CharacterData->ProxyInterpParamMap.Contains(MovementState))
+		ProxyInterpState = MovementState;
+	else
+		ProxyInterpState = ProxyMovementState;
+}
+
+void APHCharacter::AddProxySnapshot(const FPHProxySnapshot& Snapshot)
+{
+	if (ProxySnapshots.IsEmpty())
+	{
+		BeginProxyBuffer();
+
+		auto* InterpParam = FindProxyInterpParam();
+
+		FPHProxySnapshot CurrentSnapshot;
+		CurrentSnapshot.Time = Snapshot.Time - (InterpParam ? InterpParam->InterpolationDelay : 0.f);
+		CurrentSnapshot.Location = GetActorLocation();
+		CurrentSnapshot.Rotation = GetActorQuat();
+		ProxySnapshots.Add(CurrentSnapshot);
+	}
+
+	ProxySnapshots.Add(Snapshot);
+}
+
+void APHCharacter::AddProxyEvent(const FPHProxyEvent& Event)
+{
+	BeginProxyBuffer();
+
+	ProxyEvents.Add(Event);
+}
+
+void APHCharacter::TickProxySnapshots()
+{
+	FPHHitchScope HitchScope(this, TEXT("TickProxySnapshots"));
+
+	auto* InterpParam = FindProxyInterpParam();
+	if (!InterpParam || !GetWorld() || (ProxySnapshots.IsEmpty() && ProxyEvents.Num() == 0))
+		return;
+
+	float RenderTime = GetWorld()->GetTimeSeconds() - InterpParam->InterpolationDelay;
+
+	while (ProxyEvents.Num() > 0 && ProxyEvents[0].Time <= RenderTime)
+	{
+		FPHProxyEvent Event = ProxyEvents[0];
+		ProxyEvents.RemoveAt(0);
+
+		if (Event.bJumpToClimb)
+			JumpToClimb(Event.JumpOrientation);
+		else
+			ChangeMovementState(Event.MovementState);
+	}
+
+	FVector Location;
+	FQuat Rotation;
+	if (ProxySnapshots.Sample(RenderTime, InterpParam->MaxExtrapolationTime, Location, Rotation))
+		SetActorLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::None);
+
+	if (CharacterData->ProxyInterpParamMap.Contains(MovementState) || ProxyEvents.Num() > 0)
+		return;
+
+	if (ProxySnapshots.IsEmpty() || RenderTime >= ProxySnapshots.Snapshots.Last().Time)
+	{
+		ProxySnapshots.Reset();
+		GetCharacterMovement()->SetComponentTickEnabled(true);
+		Super::PostNetReceiveLocationAndRotation();
+	}
+}
+
 void APHCharacter::TurnOffWalkingAndSprinting()
 {
 	if (CharacterData && CharacterData->bPersistentWalking)
 		return;
 
+	// On authority the implementations run directly, so the profiler only sees RPCs that crossed the wire.
+	if (HasAuthority())
+	{
+		if (bWalking)
+			ServerSetWalking_Implementation(false);
+
+		if (bSprinting)
+			ServerSetSprinting_Implementation(false);
+		return;
+	}
+
 	if (bWalking)
 		ServerSetWalking(false);
 
@@ -238,11 +829,15 @@ void APHCharacter::TurnOffWalkingAndSprinting()
 
 void APHCharacter::ServerSetWalking_Implementation(bool bInWalking)
 {
+	RecordRPC(TEXT("ServerSetWalking"));
+
 	bWalking = bInWalking;
 }
 
 void APHCharacter::ServerSetSprinting_Implementation(bool bInSprinting)
 {
+	RecordRPC(TEXT("ServerSetSprinting"));
+
 	bSprinting = bInSprinting;
 }
 
@@ -282,20 +877,25 @@ void APHCharacter::ChangeMaxSpeed()
 
 void APHCharacter::StartMantle()
 {
+	FPHHitchScope HitchScope(this, TEXT("StartMantle"));
+
 	if (!CharacterData)
 		return;
 
-	if (CharacterData->bMantleDisabledCollision)
-		GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-
 	auto* MantleParam = CharacterData->MantleParamMap.Find(MantleType);
-	auto* AnimInstance = GetMesh()->GetAnimInstance();
+	auto* AnimInstance = ShouldRunCosmetics() ? GetMesh()->GetAnimInstance() : nullptr;
 
-	if (!MantleParam || !MantleParam->Montage || !AnimInstance)
+	if (!MantleParam || !MantleParam->Montage || (!AnimInstance && ShouldRunCosmetics()))
 		return;
 
 	float MontageStartPosition = MantleParam->Montage->GetPlayLength() * UKismetMathLibrary::MapRangeClamped(MantleHeight, MantleParam->MaxHeight, MantleParam->MinHeight, MantleParam->MaxHeightTime, MantleParam->MinHeightTime);
-	float MontageTimeLength = AnimInstance->Montage_Play(MantleParam->Montage, CharacterData->MantlePlayRate, EMontagePlayReturnType::MontageLength, MontageStartPosition, true);
+	float MontageTimeLength = AnimInstance ? AnimInstance->Montage_Play(MantleParam->Montage, CharacterData->MantlePlayRate, EMontagePlayReturnType::MontageLength, MontageStartPosition, true) : MantleParam->Montage->GetPlayLength();
+
+	if (GetLocalRole() == ROLE_SimulatedProxy && FindProxyInterpParam())
+		return;
+
+	if (CharacterData->bMantleDisabledCollision)
+		GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
 	FVector NewLocation = GetActorLocation() + ((MantleEndTransform.MantleForwardTransform * MantleEndTransform.ComponentTransform).GetRotation().GetForwardVector() * -5.f);
 	FHitResult OutSweepHitResult;
@@ -305,6 +905,7 @@ void APHCharacter::StartMantle()
 	FTransform NewTransform_2 = MantleEndTransform.MantleForwardTransform * (MantleEndTransform.Component ? MantleEndTransform.Component->GetComponentTransform() : MantleEndTransform.ComponentTransform);
 	float OverTime_1 = (MantleParam->MoveForwardTime - MontageStartPosition) / CharacterData->MantlePlayRate;
 	float OverTime_2 = (MontageTimeLength - MantleParam->MoveForwardTime) / CharacterData->MantlePlayRate;
+	int32 MantleIterations = 0;
 
 	if (OverTime_1 > 0.f && GetWorld())
 	{
@@ -317,6 +918,7 @@ void APHCharacter::StartMantle()
 			FRotator DeltaRotation = UKismetMathLibrary::RLerp(GetActorRotation(), NewTransform_1.GetRotation().Rotator(), WorldDeltaSeconds / OverTime_1, true);
 			SetActorLocationAndRotation(DeltaLocation, DeltaRotation, true, &OutSweepHitResult, ETeleportType::None);
 			WorldDeltaSeconds += UKismetMathLibrary::Clamp(WorldDeltaSeconds + UGameplayStatics::GetWorldDeltaSeconds(this), 0.f, OverTime_1);
+			++MantleIterations;
 		}
 		while (WorldDeltaSeconds < OverTime_1);
 	}
@@ -334,17 +936,23 @@ void APHCharacter::StartMantle()
 			FRotator DeltaRotation = UKismetMathLibrary::RLerp(GetActorRotation(), NewTransform_2.GetRotation().Rotator(), WorldDeltaSeconds / OverTime_2, true);
 			SetActorLocationAndRotation(DeltaLocation, DeltaRotation, true, &OutSweepHitResult, ETeleportType::None);
 			WorldDeltaSeconds += UKismetMathLibrary::Clamp(WorldDeltaSeconds + UGameplayStatics::GetWorldDeltaSeconds(this), 0.f, OverTime_2);
+			++MantleIterations;
 		} while (WorldDeltaSeconds < OverTime_2);
 	}
 	else
 		SetActorLocationAndRotation(NewTransform_2.GetLocation(), NewTransform_2.GetRotation().Rotator(), true, &OutSweepHitResult, ETeleportType::None);
 
+	UPHHitchWatchdog::Record(this, EPHHitchEventType::Iteration, TEXT("StartMantle"), MantleIterations);
+
 	if (CharacterData->bMantleDisabledCollision)
 		GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
 
 	bMantle = false;
 
-	ServerChangeMovementState(EMovementState::Ground);
+	if (HasAuthority())
+		ServerChangeMovementState_Implementation(EMovementState::Ground);
+	else
+		ServerChangeMovementState(EMovementState::Ground);
 	ChangeMovementState(EMovementState::Ground);
 }
 
@@ -433,6 +1041,9 @@ void APHCharacter::TogglePerspective()
 {
 	bUsingFpView = !bUsingFpView;
 
+	if (!SpringArm)
+		return;
+
 	SpringArm->TargetArmLength = bUsingFpView ? 0.f : 200.f;
 	SpringArm->SetRelativeLocation(bUsingFpView ? FVector(0.f) : FVector(-3.f, 30.f, 20.f));
 }
@@ -509,34 +1120,193 @@ void APHCharacter::CheckJumpingToClimb()
 	ServerJumpToClimb(JumpOrientation);
 }
 
+void APHCharacter::UpdateClimbing(float DeltaSeconds)
+{
+	FPHHitchScope HitchScope(this, TEXT("UpdateClimbing"));
+
+	if (!CharacterData || !GetWorld())
+		return;
+
+	static const FVector2D ProbePattern[ClimbingProbeCount] =
+	{
+		FVector2D(-1.f, 1.f), FVector2D(1.f, 1.f), FVector2D(-1.f, 0.f), FVector2D(1.f, 0.f),
+		FVector2D(-1.f, -1.f), FVector2D(1.f, -1.f), FVector2D(0.f, 0.5f), FVector2D(0.f, -0.5f)
+	};
+
+	FVector Right;
+	FVector Up;
+	GetClimbingAxes(Right, Up);
+
+	float Radius = GetCapsuleComponent()->GetScaledCapsuleRadius();
+	float HalfHeight = GetCapsuleComponent()->GetScaledCapsuleHalfHeight() - Radius;
+	FVector Origin = GetCapsuleComponent()->GetComponentLocation();
+	FVector ProbeDelta = -ClimbingNormal * (Radius + CharacterData->ClimbingProbeDistance);
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbingProbe), false, this);
+
+	alignas(16) float U[ClimbingProbeCount];
+	alignas(16) float V[ClimbingProbeCount];
+	alignas(16) float D[ClimbingProbeCount];
+	alignas(16) float W[ClimbingProbeCount];
+	float NearestDistance = -BIG_NUMBER;
+	UPrimitiveComponent* NearestComponent = nullptr;
+	FBox2D HitBounds(ForceInit);
+
+	for (int32 Index = 0; Index < ClimbingProbeCount; ++Index)
+	{
+		U[Index] = ProbePattern[Index].X;
+		V[Index] = ProbePattern[Index].Y;
+		D[Index] = 0.f;
+		W[Index] = 0.f;
+
+		FVector Start = Origin + Right * (U[Index] * Radius) + Up * (V[Index] * HalfHeight);
+		FHitResult Hit;
+		if (!GetWorld()->LineTraceSingleByProfile(Hit, Start, Start + ProbeDelta, TEXT("Pawn"), QueryParams))
+			continue;
+
+		D[Index] = FVector::DotProduct(Hit.ImpactPoint - Origin, ClimbingNormal);
+		W[Index] = 1.f;
+		HitBounds += ProbePattern[Index];
+
+		if (D[Index] > NearestDistance)
+		{
+			NearestDistance = D[Index];
+			NearestComponent = Hit.GetComponent();
+		}
+	}
+
+	UPHHitchWatchdog::Record(this, EPHHitchEventType::Probe, TEXT("UpdateClimbing"), ClimbingProbeCount);
+
+	float A;
+	float B;
+	float C;
+	// A plane is only observable when the hits span at least two columns and two rows of the pattern.
+	FVector2D HitExtent = HitBounds.GetSize();
+	if (HitExtent.X <= 0.f || HitExtent.Y <= 0.f || !FitClimbingPlane(U, V, D, W, A, B, C))
+	{
+		if (!bJumpingToClimb && IsLocallyControlled() && !bClientUpdating)
+		{
+			ServerChangeMovementState(EMovementState::Falling);
+			ChangeMovementState(EMovementState::Falling);
+		}
+		return;
+	}
+
+	FVector FitNormal = (ClimbingNormal - Right * (A / Radius) - Up * (B / FMath::Max(HalfHeight, KINDA_SMALL_NUMBER))).GetSafeNormal();
+	if (FitNormal.IsNearlyZero())
+		return;
+
+	ClimbingNormal = FitNormal;
+	ClimbingBase = NearestComponent;
+	GetCharacterMovement()->SetPlaneConstraintNormal(ClimbingNormal);
+
+	FRotator TargetRotation(0.f, (-ClimbingNormal).Rotation().Yaw, 0.f);
+	FQuat NewRotation = FMath::RInterpTo(GetActorRotation(), TargetRotation, DeltaSeconds, CharacterData->ClimbingRotationInterpSpeed).Quaternion();
+	FVector WallOffset = bJumpingToClimb ? FVector(0.f) : ClimbingNormal * (Radius + CharacterData->ClimbingWallOffset + C);
+
+	// The offset is along the plane constraint normal, so it bypasses the movement component's plane projection.
+	FHitResult Hit;
+	GetCapsuleComponent()->MoveComponent(WallOffset, NewRotation, true, &Hit);
+}
+
+void APHCharacter::GetClimbingAxes(FVector& OutRight, FVector& OutUp) const
+{
+	OutRight = FVector::CrossProduct(FVector::UpVector, -ClimbingNormal).GetSafeNormal();
+	OutUp = FVector::CrossProduct(-ClimbingNormal, OutRight).GetSafeNormal();
+}
+
 void APHCharacter::JumpToClimb(const FVector& JumpOrientation)
 {
+	if (MovementState != EMovementState::Climbing || !CharacterData)
+		return;
+
+	FVector Right;
+	FVector Up;
+	GetClimbingAxes(Right, Up);
+
+	FVector Direction = (Up * JumpOrientation.X + Right * JumpOrientation.Y).GetSafeNormal();
+	bJumpingToClimb = true;
 
+	if (CharacterData->JumpToClimbingInitialDelay > 0.f)
+		GetWorldTimerManager().SetTimer(JumpToClimbTimerHandle, FTimerDelegate::CreateUObject(this, &APHCharacter::LaunchJumpToClimb, Direction), CharacterData->JumpToClimbingInitialDelay, false);
+	else
+		LaunchJumpToClimb(Direction);
+}
+
+void APHCharacter::LaunchJumpToClimb(FVector Direction)
+{
+	if (MovementState != EMovementState::Climbing || !CharacterData)
+	{
+		bJumpingToClimb = false;
+		return;
+	}
+
+	GetCharacterMovement()->MaxFlySpeed = CharacterData->JumpToClimbingVelocity;
+	GetCharacterMovement()->Velocity = Direction * CharacterData->JumpToClimbingVelocity;
+
+	if (CharacterData->JumpToClimbingLength > 0.f)
+		GetWorldTimerManager().SetTimer(JumpToClimbTimerHandle, this, &APHCharacter::FinishJumpToClimb, CharacterData->JumpToClimbingLength, false);
+	else
+		FinishJumpToClimb();
+}
+
+void APHCharacter::FinishJumpToClimb()
+{
+	bJumpingToClimb = false;
+	ChangeMaxSpeed();
 }
 
 void APHCharacter::ServerJumpToClimb_Implementation(const FVector& JumpOrientation)
 {
+	RecordRPC(TEXT("ServerJumpToClimb"));
+
 	MulticastJumpToClimb(JumpOrientation);
 }
 
 void APHCharacter::MulticastJumpToClimb_Implementation(const FVector& JumpOrientation)
 {
+	RecordRPC(TEXT("MulticastJumpToClimb"));
+
+	if (ShouldBufferProxy(MovementState))
+	{
+		FPHProxyEvent Event;
+		Event.Time = GetWorld()->GetTimeSeconds();
+		Event.MovementState = ProxyMovementState;
+		Event.bJumpToClimb = true;
+		Event.JumpOrientation = JumpOrientation;
+		AddProxyEvent(Event);
+		return;
+	}
+
 	if (!IsLocallyControlled())
 		JumpToClimb(JumpOrientation);
 }
 
 void APHCharacter::JumpOffWhileClimbing(const FVector& JumpOrientation)
 {
+	if (MovementState != EMovementState::Climbing || !CharacterData)
+		return;
+
+	FVector Right;
+	FVector Up;
+	GetClimbingAxes(Right, Up);
 
+	FVector Direction = (ClimbingNormal * -JumpOrientation.X + Right * JumpOrientation.Y).GetSafeNormal();
+
+	ChangeMovementState(EMovementState::Falling);
+	LaunchCharacter(Direction * CharacterData->JumpOffClimbingVelocity + FVector(0.f, 0.f, GetCharacterMovement()->JumpZVelocity), true, true);
 }
 
 void APHCharacter::ServerJumpOffWhileClimbing_Implementation(const FVector& JumpOrientation)
 {
+	RecordRPC(TEXT("ServerJumpOffWhileClimbing"));
+
 	MulticastJumpOffWhileClimbing(JumpOrientation);
 }
 
 void APHCharacter::MulticastJumpOffWhileClimbing_Implementation(const FVector& JumpOrientation)
 {
+	RecordRPC(TEXT("MulticastJumpOffWhileClimbing"));
+
 	if (!IsLocallyControlled())
 		JumpOffWhileClimbing(JumpOrientation);
 }
@@ -549,17 +1319,23 @@ void APHCharacter::JumpWhileSlidingOnSlope(const FVector& LaunchVelocity)
 
 void APHCharacter::ServerJumpWhileSlidingOnSlope_Implementation(const FVector& LaunchVelocity)
 {
+	RecordRPC(TEXT("ServerJumpWhileSlidingOnSlope"));
+
 	MulticastJumpWhileSlidingOnSlope(LaunchVelocity);
 }
 
 void APHCharacter::MulticastJumpWhileSlidingOnSlope_Implementation(const FVector& LaunchVelocity)
 {
+	RecordRPC(TEXT("MulticastJumpWhileSlidingOnSlope"));
+
 	if (!IsLocallyControlled())
 		JumpWhileSlidingOnSlope(LaunchVelocity);
 }
 
 bool APHCharacter::CanGlide()
 {
+	FPHHitchScope HitchScope(this, TEXT("CanGlide"));
+
 	if (!CharacterData)
 		return false;
 
@@ -568,13 +1344,16 @@ bool APHCharacter::CanGlide()
 	FVector EndLocation = BaseLocation + FVector(0.f, 0.f, CharacterData->GlidingStartHeight);
 	FHitResult OutHit;
 	bool bSucceeded = UKismetSystemLibrary::SphereTraceSingleByProfile(this, StartLocation, EndLocation, GetCapsuleComponent()->GetScaledCapsuleRadius(), TEXT("Pawn"), false, TArray<AActor*>{}, EDrawDebugTrace::None, OutHit, true, FLinearColor::White, FLinearColor::White, 0.f);
+	UPHHitchWatchdog::Record(this, EPHHitchEventType::Probe, TEXT("CanGlide"), 1);
 	
 	return !(bSucceeded && GetCharacterMovement()->IsWalkable(OutHit));
 }
 
 void APHCharacter::SpawnGlider()
 {
-	if (MovementState != EMovementState::Gliding || !CharacterData || CharacterData->Glider.IsNull() || !GetWorld())
+	FPHHitchScope HitchScope(this, TEXT("SpawnGlider"));
+
+	if (MovementState != EMovementState::Gliding || !ShouldRunCosmetics() || !CharacterData || CharacterData->Glider.IsNull() || !GetWorld())
 		return;
 
 	FVector Location;
@@ -583,6 +1362,7 @@ void APHCharacter::SpawnGlider()
 	ActorSpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
 
 	Glider = GetWorld()->SpawnActor(CharacterData->Glider.Get(), &Location, &Rotation, ActorSpawnParameters);
+	UPHHitchWatchdog::Record(this, EPHHitchEventType::Spawn, TEXT("SpawnGlider"));
 	if (Glider)
 		Glider->K2_AttachToComponent(GetMesh(), TEXT("GliderSocket"), EAttachmentRule::KeepRelative, EAttachmentRule::KeepRelative, EAttachmentRule::KeepRelative, true);
 }
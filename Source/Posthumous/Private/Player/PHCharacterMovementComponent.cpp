@@ -0,0 +1,211 @@
+#include "Player/PHCharacterMovementComponent.h"
+#include "Data/PHCharacterData.h"
+#include "Player/PHCharacter.h"
+
+#include "Components/SkeletalMeshComponent.h"
+
+void FPHSavedMove::Clear()
+{
+	Super::Clear();
+
+	SavedGlidingTimeAccumulator = 0.f;
+}
+
+void FPHSavedMove::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	Super::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if (auto* Movement = Cast<UPHCharacterMovementComponent>(C->GetCharacterMovement()))
+		SavedGlidingTimeAccumulator = Movement->GlidingTimeAccumulator;
+}
+
+void FPHSavedMove::PrepMoveFor(ACharacter* C)
+{
+	Super::PrepMoveFor(C);
+
+	if (auto* Movement = Cast<UPHCharacterMovementComponent>(C->GetCharacterMovement()))
+		Movement->GlidingTimeAccumulator = SavedGlidingTimeAccumulator;
+}
+
+void FPHSavedMove::CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter, APlayerController* PC, const FVector& OldStartLocation)
+{
+	Super::CombineWith(OldMove, InCharacter, PC, OldStartLocation);
+
+	// The combined move is replayed from the old move's start, so it has to start from its accumulator too.
+	SavedGlidingTimeAccumulator = static_cast<const FPHSavedMove*>(OldMove)->SavedGlidingTimeAccumulator;
+
+	if (auto* Movement = Cast<UPHCharacterMovementComponent>(InCharacter->GetCharacterMovement()))
+		Movement->GlidingTimeAccumulator = SavedGlidingTimeAccumulator;
+}
+
+void FPHCharacterNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType)
+{
+	Super::ClientFillNetworkMoveData(ClientMove, MoveType);
+
+	GlidingTimeAccumulator = static_cast<const FPHSavedMove&>(ClientMove).SavedGlidingTimeAccumulator;
+}
+
+bool FPHCharacterNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+	Super::Serialize(CharacterMovement, Ar, PackageMap, MoveType);
+
+	bool bHasGlidingTime = GlidingTimeAccumulator > 0.f;
+	Ar.SerializeBits(&bHasGlidingTime, 1);
+
+	if (bHasGlidingTime)
+		Ar << GlidingTimeAccumulator;
+	else
+		GlidingTimeAccumulator = 0.f;
+
+	return !Ar.IsError();
+}
+
+UPHCharacterMovementComponent::UPHCharacterMovementComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	SetNetworkMoveDataContainer(PHNetworkMoveDataContainer);
+}
+
+FNetworkPredictionData_Client* UPHCharacterMovementComponent::GetPredictionData_Client() const
+{
+	if (!ClientPredictionData)
+	{
+		auto* MutableThis = const_cast<UPHCharacterMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FPHNetworkPredictionData_Client(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+void UPHCharacterMovementComponent::PhysFalling(float deltaTime, int32 Iterations)
+{
+	auto* PHCharacter = Cast<APHCharacter>(CharacterOwner);
+	if (!PHCharacter || PHCharacter->GetMovementState() != EMovementState::Gliding || !PHCharacter->GetCharacterData())
+	{
+		GlidingTimeAccumulator = 0.f;
+		ResetGlidingPresentation();
+		Super::PhysFalling(deltaTime, Iterations);
+		return;
+	}
+
+	PhysGliding(deltaTime, Iterations, *PHCharacter->GetCharacterData());
+}
+
+void UPHCharacterMovementComponent::PhysFlying(float deltaTime, int32 Iterations)
+{
+	Super::PhysFlying(deltaTime, Iterations);
+
+	// Wall alignment runs per move so the owning client replays it exactly like the server simulates it.
+	auto* PHCharacter = Cast<APHCharacter>(CharacterOwner);
+	if (PHCharacter && PHCharacter->GetLocalRole() != ROLE_SimulatedProxy && PHCharacter->GetMovementState() == EMovementState::Climbing && MovementMode == EMovementMode::MOVE_Flying)
+		PHCharacter->UpdateClimbing(deltaTime);
+}
+
+void UPHCharacterMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode)
+{
+	GlidingTimeAccumulator = 0.f;
+	ResetGlidingPresentation();
+
+	Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+}
+
+void UPHCharacterMovementComponent::MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel)
+{
+	if (auto* MoveData = static_cast<const FPHCharacterNetworkMoveData*>(GetCurrentNetworkMoveData()))
+	{
+		auto* PHCharacter = Cast<APHCharacter>(CharacterOwner);
+		float FixedTimeStep = PHCharacter && PHCharacter->GetCharacterData() ? FMath::Max(PHCharacter->GetCharacterData()->GlidingFixedTimeStep, MIN_TICK_TIME) : 0.f;
+		GlidingTimeAccumulator = FMath::Clamp(MoveData->GlidingTimeAccumulator, 0.f, FixedTimeStep);
+	}
+
+	Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAccel);
+}
+
+void UPHCharacterMovementComponent::PhysGliding(float deltaTime, int32 Iterations, const UPHCharacterData& CharacterData)
+{
+	if (deltaTime < MIN_TICK_TIME)
+		return;
+
+	float FixedTimeStep = FMath::Max(CharacterData.GlidingFixedTimeStep, MIN_TICK_TIME);
+	GlidingTimeAccumulator = FMath::Min(GlidingTimeAccumulator + deltaTime, FixedTimeStep * MaxSimulationIterations);
+
+	while (GlidingTimeAccumulator >= FixedTimeStep)
+	{
+		GlidingTimeAccumulator -= FixedTimeStep;
+		PrevGlidingLocation = UpdatedComponent->GetComponentLocation();
+
+		if (!StepGliding(FixedTimeStep, Iterations, CharacterData))
+			return;
+	}
+
+	UpdateGlidingPresentation(GlidingTimeAccumulator / FixedTimeStep);
+}
+
+bool UPHCharacterMovementComponent::StepGliding(float FixedTimeStep, int32 Iterations, const UPHCharacterData& CharacterData)
+{
+	Velocity += ComputeGlidingAcceleration(CharacterData) * FixedTimeStep;
+
+	FVector Delta = Velocity * FixedTimeStep;
+	FHitResult Hit(1.f);
+	SafeMoveUpdatedComponent(Delta, UpdatedComponent->GetComponentQuat(), true, Hit);
+
+	// Whatever this step and the accumulator did not consume carries on in the next movement mode.
+	float RemainingTime = GlidingTimeAccumulator + FixedTimeStep * (1.f - Hit.Time);
+
+	if (Hit.bBlockingHit)
+	{
+		if (IsValidLandingSpot(UpdatedComponent->GetComponentLocation(), Hit))
+		{
+			GlidingTimeAccumulator = 0.f;
+			ProcessLanded(Hit, RemainingTime, Iterations);
+			return false;
+		}
+
+		HandleImpact(Hit, FixedTimeStep, Delta);
+		SlideAlongSurface(Delta, 1.f - Hit.Time, Hit.Normal, Hit, true);
+		Velocity = FVector::VectorPlaneProject(Velocity, Hit.Normal);
+		RemainingTime = GlidingTimeAccumulator;
+	}
+
+	if (MovementMode == EMovementMode::MOVE_Falling)
+		return true;
+
+	GlidingTimeAccumulator = 0.f;
+	StartNewPhysics(RemainingTime, Iterations);
+	return false;
+}
+
+FVector UPHCharacterMovementComponent::ComputeGlidingAcceleration(const UPHCharacterData& CharacterData) const
+{
+	float Gravity = -UMovementComponent::GetGravityZ();
+	float Pitch = FMath::DegreesToRadians(FMath::Clamp(FRotator::NormalizeAxis(CharacterOwner->GetControlRotation().Pitch), -CharacterData.GlidingMaxPitch, CharacterData.GlidingMaxPitch));
+	float Lift = FMath::Min(CharacterData.GlidingLiftCoefficient * Velocity.SizeSquared2D(), Gravity) * FMath::Cos(Pitch);
+
+	FVector Result(0.f, 0.f, Lift - Gravity);
+	Result += CharacterOwner->GetActorForwardVector().GetSafeNormal2D() * Gravity * -FMath::Sin(Pitch);
+	Result -= Velocity * Velocity.Size() * CharacterData.GlidingDragCoefficient;
+	Result += FVector(Acceleration.X, Acceleration.Y, 0.f) * AirControl;
+
+	return Result;
+}
+
+void UPHCharacterMovementComponent::UpdateGlidingPresentation(float Alpha)
+{
+	if (!CharacterOwner->IsLocallyControlled() || !CharacterOwner->GetMesh())
+		return;
+
+	FVector CurrentLocation = UpdatedComponent->GetComponentLocation();
+	FVector VisualOffset = FMath::Lerp(PrevGlidingLocation, CurrentLocation, Alpha) - CurrentLocation;
+
+	CharacterOwner->GetMesh()->SetRelativeLocation(CharacterOwner->GetBaseTranslationOffset() + UpdatedComponent->GetComponentQuat().UnrotateVector(VisualOffset));
+	bGlidingPresentationOffset = true;
+}
+
+void UPHCharacterMovementComponent::ResetGlidingPresentation()
+{
+	if (!bGlidingPresentationOffset || !CharacterOwner || !CharacterOwner->GetMesh())
+		return;
+
+	CharacterOwner->GetMesh()->SetRelativeLocation(CharacterOwner->GetBaseTranslationOffset());
+	bGlidingPresentationOffset = false;
+}
@@ -0,0 +1,124 @@
+#include "Player/PHCharacterPool.h"
+#include "Data/PHCharacterData.h"
+#include "Player/PHCharacter.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Controller.h"
+
+DEFINE_LOG_CATEGORY(LogPHCharacterPool);
+
+void UPHCharacterPool::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (InWorld.GetNetMode() == NM_Client)
+		return;
+
+	auto* CharacterData = GetDefault<APHCharacter>()->GetCharacterData();
+	if (!CharacterData || CharacterData->PooledCharacterClass.IsNull())
+		return;
+
+	TSubclassOf<APHCharacter> CharacterClass = CharacterData->PooledCharacterClass.LoadSynchronous();
+	if (!CharacterClass)
+		return;
+
+	for (int32 Index = PooledCharacters.Num(); Index < GetPoolSize(); ++Index)
+	{
+		if (auto* Character = SpawnCharacter(CharacterClass, FTransform::Identity))
+		{
+			Character->DeactivateForPool();
+			PooledCharacters.Add(Character);
+		}
+	}
+}
+
+void UPHCharacterPool::Deinitialize()
+{
+	if (ReuseCount > 0)
+		UE_LOG(LogPHCharacterPool, Log, TEXT("%d spawns (%.2f ms avg), %d reuses (%.2f ms avg), %.2f ms saved"), SpawnCount, SpawnCount > 0 ? SpawnSeconds / SpawnCount * 1000.0 : 0.0, ReuseCount, ReuseSeconds / ReuseCount * 1000.0, GetSavedSpawnSeconds() * 1000.f);
+
+	PooledCharacters.Reset();
+
+	Super::Deinitialize();
+}
+
+APHCharacter* UPHCharacterPool::Acquire(TSubclassOf<APHCharacter> CharacterClass, const FTransform& Transform, AController* Controller)
+{
+	if (!CharacterClass || !GetWorld())
+		return nullptr;
+
+	PooledCharacters.RemoveAllSwap([](const APHCharacter* Character) { return !IsValid(Character); });
+
+	double StartTime = FPlatformTime::Seconds();
+	int32 Index = PooledCharacters.IndexOfByPredicate([CharacterClass](const APHCharacter* Character) { return Character->GetClass() == CharacterClass; });
+
+	APHCharacter* Character = nullptr;
+	if (Index != INDEX_NONE)
+	{
+		Character = PooledCharacters[Index];
+		PooledCharacters.RemoveAtSwap(Index);
+		Character->ActivateFromPool(Transform);
+
+		if (Controller)
+			Controller->Possess(Character);
+
+		ReuseSeconds += FPlatformTime::Seconds() - StartTime;
+		++ReuseCount;
+		return Character;
+	}
+
+	Character = SpawnCharacter(CharacterClass, Transform);
+	if (!Character)
+		return nullptr;
+
+	if (Controller)
+		Controller->Possess(Character);
+
+	SpawnSeconds += FPlatformTime::Seconds() - StartTime;
+	++SpawnCount;
+	return Character;
+}
+
+void UPHCharacterPool::Release(APHCharacter* Character)
+{
+	if (!Character || !Character->HasAuthority())
+		return;
+
+	if (auto* Controller = Character->GetController())
+		Controller->UnPossess();
+
+	if (PooledCharacters.Num() >= GetPoolSize())
+	{
+		Character->Destroy();
+		return;
+	}
+
+	Character->DeactivateForPool();
+	PooledCharacters.Add(Character);
+}
+
+float UPHCharacterPool::GetSavedSpawnSeconds() const
+{
+	if (SpawnCount == 0 || ReuseCount == 0)
+		return 0.f;
+
+	return FMath::Max(0.0, (SpawnSeconds / SpawnCount - ReuseSeconds / ReuseCount) * ReuseCount);
+}
+
+int32 UPHCharacterPool::GetPoolSize() const
+{
+	auto* CharacterData = GetDefault<APHCharacter>()->GetCharacterData();
+	if (!CharacterData || !GetWorld())
+		return 0;
+
+	auto* PoolSize = CharacterData->PoolSizeMap.Find(FName(*UWorld::RemovePIEPrefix(GetWorld()->GetMapName())));
+	return PoolSize ? *PoolSize : CharacterData->DefaultPoolSize;
+}
+
+APHCharacter* UPHCharacterPool::SpawnCharacter(TSubclassOf<APHCharacter> CharacterClass, const FTransform& Transform)
+{
+	FActorSpawnParameters ActorSpawnParameters;
+	ActorSpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	return GetWorld()->SpawnActor<APHCharacter>(CharacterClass, Transform, ActorSpawnParameters);
+}
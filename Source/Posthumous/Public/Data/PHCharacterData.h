@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
+#include "Player/PHCharacter.h"
 #include "PHCharacterData.generated.h"
 
 UENUM()
@@ -30,12 +31,39 @@ struct FPHMantleParam
 	class UAnimMontage* Montage;
 };
 
+USTRUCT()
+struct FPHProxyInterpParam
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY(EditDefaultsOnly)
+	float InterpolationDelay = 0.1f;
+
+	UPROPERTY(EditDefaultsOnly)
+	float MaxExtrapolationTime = 0.05f;
+};
+
 UCLASS()
 class POSTHUMOUS_API UPHCharacterData : public UDataAsset
 {
 	GENERATED_BODY()
 	
 public:
+	UPROPERTY(EditDefaultsOnly, Category = "Camera")
+	float CameraOcclusionInterpSpeed = 10.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Climbing")
+	float ClimbingProbeDistance = 30.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Climbing")
+	float ClimbingRotationInterpSpeed = 10.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Climbing")
+	float ClimbingWallOffset = 5.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Climbing")
+	float JumpOffClimbingVelocity = 400.f;
+
 	UPROPERTY(EditDefaultsOnly, Category = "Climbing")
 	float JumpToClimbingAnimPlayRate;
 
@@ -69,9 +97,21 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Gliding")
 	float GlidingAirControl;
 
+	UPROPERTY(EditDefaultsOnly, Category = "Gliding")
+	float GlidingDragCoefficient = 0.0025f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Gliding")
+	float GlidingFixedTimeStep = 1.f / 60.f;
+
 	UPROPERTY(EditDefaultsOnly, Category = "Gliding")
 	float GlidingLateralDeceleration;
 
+	UPROPERTY(EditDefaultsOnly, Category = "Gliding")
+	float GlidingLiftCoefficient = 0.0025f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Gliding")
+	float GlidingMaxPitch = 30.f;
+
 	UPROPERTY(EditDefaultsOnly, Category = "Gliding")
 	FRotator GlidingRotationRate;
 
@@ -99,6 +139,18 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Mantle")
 	float MantlePlayRate;
 
+	UPROPERTY(EditDefaultsOnly, Category = "Network")
+	TMap<EMovementState, FPHProxyInterpParam> ProxyInterpParamMap;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Pool")
+	int32 DefaultPoolSize;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Pool")
+	TMap<FName, int32> PoolSizeMap;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Pool")
+	TSoftClassPtr<APHCharacter> PooledCharacterClass;
+
 	UPROPERTY(EditDefaultsOnly, Category = "Swimming")
 	float MaxSwimmingSpeed;
 
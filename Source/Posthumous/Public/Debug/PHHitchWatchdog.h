@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Player/PHCharacter.h"
+#include "PHHitchWatchdog.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogPHHitch, Log, All);
+
+UENUM()
+enum class EPHHitchEventType : uint8
+{
+	Transition,
+	RPC,
+	Spawn,
+	Probe,
+	Iteration,
+	Scope
+};
+
+USTRUCT()
+struct FPHHitchEvent
+{
+	GENERATED_USTRUCT_BODY()
+
+	EPHHitchEventType Type;
+	const TCHAR* Name;
+	uint32 CharacterId;
+	FName CharacterName;
+	EMovementState MovementState;
+	int32 Count;
+	double Duration;
+};
+
+USTRUCT()
+struct FPHHitchFrame
+{
+	GENERATED_USTRUCT_BODY()
+
+	uint64 FrameNumber = 0;
+	double Duration = 0.0;
+	TArray<FPHHitchEvent> Events;
+};
+
+UCLASS()
+class POSTHUMOUS_API UPHHitchWatchdog : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static bool IsEnabled();
+	static void Record(const APHCharacter* Character, EPHHitchEventType Type, const TCHAR* Name, int32 Count = 0, double Duration = 0.0);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	void AddEvent(const FPHHitchEvent& Event);
+	void Dump(double FrameDuration);
+
+private:
+	TArray<FPHHitchFrame> Frames;
+	int32 FrameIndex = 0;
+	double FrameStartTime = 0.0;
+};
+
+struct POSTHUMOUS_API FPHHitchScope
+{
+	FPHHitchScope(const APHCharacter* InCharacter, const TCHAR* InName);
+	~FPHHitchScope();
+
+	const APHCharacter* Character;
+	const TCHAR* Name;
+	double StartTime;
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Player/PHCharacter.h"
+#include "PHNetProfiler.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogPHNetProfiler, Log, All);
+
+UENUM()
+enum class EPHNetDirection : uint8
+{
+	Outgoing,
+	Incoming
+};
+
+struct FPHNetProfileKey
+{
+	FName Connection;
+	FName Name;
+	EPHNetDirection Direction;
+	EMovementState MovementState;
+
+	bool operator==(const FPHNetProfileKey& Other) const
+	{
+		return Connection == Other.Connection && Name == Other.Name && Direction == Other.Direction && MovementState == Other.MovementState;
+	}
+
+	friend uint32 GetTypeHash(const FPHNetProfileKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.Connection), GetTypeHash(Key.Name)), (uint32(Key.Direction) << 8) | uint32(Key.MovementState));
+	}
+};
+
+struct FPHNetProfileStat
+{
+	int64 Bits = 0;
+	int32 Count = 0;
+};
+
+UCLASS()
+class POSTHUMOUS_API UPHNetProfiler : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static bool IsEnabled();
+	static void RecordProperties(const APHCharacter* Character, const FPHNetPropertySnapshot& OldSnapshot, const FPHNetPropertySnapshot& NewSnapshot, EPHNetDirection Direction);
+	static void RecordRPC(const APHCharacter* Character, UFunction* Function, void* Parameters, EPHNetDirection Direction);
+
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	static int64 GetRPCBits(UFunction* Function, void* Parameters);
+	static void GetConnections(const APHCharacter* Character, EPHNetDirection Direction, bool bMulticast, TArray<UNetConnection*>& OutConnections);
+	void Add(const APHCharacter* Character, const TArray<UNetConnection*>& Connections, FName Name, EPHNetDirection Direction, int64 Bits);
+	void Flush();
+
+private:
+	TMap<FPHNetProfileKey, FPHNetProfileStat> Stats;
+	float ElapsedTime = 0.f;
+};
@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "WorldCollision.h"
 #include "PHCharacter.generated.h"
 
 UENUM()
@@ -23,6 +24,18 @@ enum class ERotationMode : uint8
 	VelocityDirection
 };
 
+USTRUCT()
+struct FPHNetPropertySnapshot
+{
+	GENERATED_USTRUCT_BODY()
+
+	bool bWalking;
+	bool bSprinting;
+	EMovementState MovementState;
+	ERotationMode RotationMode;
+	FRepMovement ReplicatedMovement;
+};
+
 USTRUCT()
 struct FPHMantleEndTransform
 {
@@ -35,7 +48,45 @@ struct FPHMantleEndTransform
 	UPrimitiveComponent* Component;
 };
 
+USTRUCT()
+struct FPHProxySnapshot
+{
+	GENERATED_USTRUCT_BODY()
+
+	float Time;
+	FVector Location;
+	FQuat Rotation;
+};
+
+USTRUCT()
+struct FPHProxyEvent
+{
+	GENERATED_USTRUCT_BODY()
+
+	float Time;
+	EMovementState MovementState;
+
+	bool bJumpToClimb;
+	FVector JumpOrientation;
+};
+
+USTRUCT()
+struct FPHProxySnapshotBuffer
+{
+	GENERATED_USTRUCT_BODY()
+
+	static constexpr int32 MaxSnapshots = 32;
+
+	void Add(const FPHProxySnapshot& Snapshot);
+	bool Sample(float RenderTime, float MaxExtrapolationTime, FVector& OutLocation, FQuat& OutRotation) const;
+	void Reset() { Snapshots.Reset(); }
+	bool IsEmpty() const { return Snapshots.Num() == 0; }
+
+	TArray<FPHProxySnapshot> Snapshots;
+};
+
 enum class EMantleType : uint8;
+struct FPHProxyInterpParam;
 
 UCLASS()
 class POSTHUMOUS_API APHCharacter : public ACharacter
@@ -45,12 +96,44 @@ class POSTHUMOUS_API APHCharacter : public ACharacter
 public:
 	APHCharacter(const FObjectInitializer& ObjectInitializer);
 
+	virtual void Tick(float DeltaSeconds) override;
+	virtual void PostNetReceiveLocationAndRotation() override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+	virtual void PreNetReceive() override;
+	virtual void PostNetReceive() override;
+	virtual void ProcessEvent(UFunction* Function, void* Parameters) override;
+	virtual bool CallRemoteFunction(UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack) override;
+
+	EMovementState GetMovementState() const { return MovementState; }
+	class UPHCharacterData* GetCharacterData() const { return CharacterData; }
+
+	void UpdateClimbing(float DeltaSeconds);
+
+	void DeactivateForPool();
+	void ActivateFromPool(const FTransform& Transform);
+
 protected:
+	virtual void BeginPlay() override;
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode) override;
+	virtual void NotifyControllerChanged() override;
 
 private:
+	bool ShouldRunCosmetics() const;
+
+	void ResetMovementState();
+	UFUNCTION()
+	void OnRepPooled();
+
+	FPHNetPropertySnapshot MakeNetPropertySnapshot() const;
+	void RecordRPC(const TCHAR* Name);
+
+	void CreateCameraRig();
+	void DestroyCameraRig();
+	void UpdateCameraOcclusion(float DeltaSeconds);
+	void OnCameraProbeCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
 	void OnMovementModeChanged(EMovementMode PrevMovementMode, EMovementMode NewMovementMode);
 	void ChangeMovementState(EMovementState InMovementState);
 	UFUNCTION(Server, Reliable)
@@ -59,6 +142,16 @@ private:
 	void MulticastChangeMovementState(EMovementState InMovementState);
 	void ApplyMovementState();
 
+	const FPHProxyInterpParam* FindProxyInterpParam() const;
+	bool ShouldBufferProxy(EMovementState InMovementState) const;
+	void ReceiveProxyMovementState(EMovementState InMovementState);
+	void BeginProxyBuffer();
+	void AddProxySnapshot(const FPHProxySnapshot& Snapshot);
+	void AddProxyEvent(const FPHProxyEvent& Event);
+	void TickProxySnapshots();
+	UFUNCTION()
+	void OnRepMovementState(EMovementState PrevMovementState);
+
 	void TurnOffWalkingAndSprinting();
 	
 	UFUNCTION(Server, Reliable)
@@ -88,7 +181,11 @@ private:
 	
 	void CheckJumpingToClimb();
 	
+	void GetClimbingAxes(FVector& OutRight, FVector& OutUp) const;
+
 	void JumpToClimb(const FVector& JumpOrientation);
+	void LaunchJumpToClimb(FVector Direction);
+	void FinishJumpToClimb();
 	UFUNCTION(Server, Reliable)
 	void ServerJumpToClimb(const FVector& JumpOrientation);
 	UFUNCTION(NetMulticast, Reliable)
@@ -126,6 +223,8 @@ private:
 	bool bSlidingCrouched;
 	bool bSlidingOnSlope;
 	bool bUsingFpView = true;
+	UPROPERTY(ReplicatedUsing = OnRepPooled)
+	bool bPooled;
 
 	bool bSavedCanWalkOffLedgesWhenCrouching;
 	float SavedBrakingDecelerationWalking;
@@ -133,7 +232,7 @@ private:
 	float SavedGroundFriction;
 	float MantleHeight;
 
-	UPROPERTY(Replicated)
+	UPROPERTY(ReplicatedUsing = OnRepMovementState)
 	EMovementState MovementState;
 
 	UPROPERTY(ReplicatedUsing = OnRepRotationMode)
@@ -143,16 +242,32 @@ private:
 	EMantleType MantleType;
 	FPHMantleEndTransform MantleEndTransform;
 
+	FPHProxySnapshotBuffer ProxySnapshots;
+	TArray<FPHProxyEvent> ProxyEvents;
+	EMovementState ProxyMovementState;
+	EMovementState ProxyInterpState;
+
+	FPHNetPropertySnapshot NetPropertySnapshot;
+
 	UPROPERTY()
 	class UPHCharacterData* CharacterData;
 
-	UPROPERTY()
+	UPROPERTY(Transient)
 	class USpringArmComponent* SpringArm;
-	UPROPERTY(BlueprintReadOnly, meta = (AllowPrivateAccess = true))
+	UPROPERTY(Transient, BlueprintReadOnly, meta = (AllowPrivateAccess = true))
 	class UCameraComponent* Camera;
+
+	FTraceDelegate CameraProbeDelegate;
+	bool bCameraProbePending;
+	float CameraProbeLength;
+	float CameraArmLength;
+	FVector LastCameraProbeStart;
+	FRotator LastCameraProbeRotation;
 	
 	UPROPERTY()
 	UPrimitiveComponent* ClimbingBase;
+	FVector ClimbingNormal;
+	FTimerHandle JumpToClimbTimerHandle;
 
 	UPROPERTY()
 	AActor* Glider;
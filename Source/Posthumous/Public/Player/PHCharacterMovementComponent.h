@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "PHCharacterMovementComponent.generated.h"
+
+class UPHCharacterData;
+
+class FPHSavedMove : public FSavedMove_Character
+{
+	typedef FSavedMove_Character Super;
+
+public:
+	virtual void Clear() override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+	virtual void CombineWith(const FSavedMove_Character* OldMove, ACharacter* InCharacter, APlayerController* PC, const FVector& OldStartLocation) override;
+
+	float SavedGlidingTimeAccumulator = 0.f;
+};
+
+class FPHNetworkPredictionData_Client : public FNetworkPredictionData_Client_Character
+{
+public:
+	FPHNetworkPredictionData_Client(const UCharacterMovementComponent& ClientMovement) : FNetworkPredictionData_Client_Character(ClientMovement) {}
+
+	virtual FSavedMovePtr AllocateNewMove() override { return FSavedMovePtr(new FPHSavedMove()); }
+};
+
+struct FPHCharacterNetworkMoveData : public FCharacterNetworkMoveData
+{
+	typedef FCharacterNetworkMoveData Super;
+
+	virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
+	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+
+	float GlidingTimeAccumulator = 0.f;
+};
+
+struct FPHCharacterNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+	FPHCharacterNetworkMoveDataContainer() { SetNetworkMoveDataReferences(MoveData[0], MoveData[1], MoveData[2]); }
+
+	FPHCharacterNetworkMoveData MoveData[3];
+};
+
+UCLASS()
+class POSTHUMOUS_API UPHCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+	friend class FPHSavedMove;
+
+public:
+	UPHCharacterMovementComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+
+protected:
+	virtual void PhysFalling(float deltaTime, int32 Iterations) override;
+	virtual void PhysFlying(float deltaTime, int32 Iterations) override;
+	virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+	virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel) override;
+
+private:
+	void PhysGliding(float deltaTime, int32 Iterations, const UPHCharacterData& CharacterData);
+	bool StepGliding(float FixedTimeStep, int32 Iterations, const UPHCharacterData& CharacterData);
+	FVector ComputeGlidingAcceleration(const UPHCharacterData& CharacterData) const;
+
+	void UpdateGlidingPresentation(float Alpha);
+	void ResetGlidingPresentation();
+
+private:
+	FPHCharacterNetworkMoveDataContainer PHNetworkMoveDataContainer;
+
+	// Time not yet stepped by the glide model, saved with every move so replays start from the same value.
+	float GlidingTimeAccumulator = 0.f;
+	FVector PrevGlidingLocation;
+	bool bGlidingPresentationOffset = false;
+};
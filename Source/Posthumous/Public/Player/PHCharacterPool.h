@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PHCharacterPool.generated.h"
+
+class APHCharacter;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogPHCharacterPool, Log, All);
+
+UCLASS()
+class POSTHUMOUS_API UPHCharacterPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable)
+	APHCharacter* Acquire(TSubclassOf<APHCharacter> CharacterClass, const FTransform& Transform, AController* Controller);
+
+	UFUNCTION(BlueprintCallable)
+	void Release(APHCharacter* Character);
+
+	UFUNCTION(BlueprintPure)
+	float GetSavedSpawnSeconds() const;
+
+private:
+	int32 GetPoolSize() const;
+	APHCharacter* SpawnCharacter(TSubclassOf<APHCharacter> CharacterClass, const FTransform& Transform);
+
+private:
+	UPROPERTY()
+	TArray<APHCharacter*> PooledCharacters;
+
+	double SpawnSeconds = 0.0;
+	int32 SpawnCount = 0;
+	double ReuseSeconds = 0.0;
+	int32 ReuseCount = 0;
+};